@@ -0,0 +1,151 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/BabyBehaveConfig.cmake.in"
+  "/root/repo/examples/CMakeLists.txt"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/tests/bdd/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-AnyNewerVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-SameMajorVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FetchContent.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython/Support.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  "/usr/src/googletest/CMakeLists.txt"
+  "/usr/src/googletest/googlemock/CMakeLists.txt"
+  "/usr/src/googletest/googlemock/cmake/gmock.pc.in"
+  "/usr/src/googletest/googlemock/cmake/gmock_main.pc.in"
+  "/usr/src/googletest/googletest/CMakeLists.txt"
+  "/usr/src/googletest/googletest/cmake/Config.cmake.in"
+  "/usr/src/googletest/googletest/cmake/gtest.pc.in"
+  "/usr/src/googletest/googletest/cmake/gtest_main.pc.in"
+  "/usr/src/googletest/googletest/cmake/internal_utils.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "BabyBehaveConfig.cmake"
+  "BabyBehaveConfigVersion.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "_deps/googletest-build/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "_deps/googletest-build/googletest/generated/gmock.pc"
+  "_deps/googletest-build/googletest/generated/gmock_main.pc"
+  "_deps/googletest-build/googlemock/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "_deps/googletest-build/googletest/generated/GTestConfigVersion.cmake"
+  "_deps/googletest-build/googletest/generated/GTestConfig.cmake"
+  "_deps/googletest-build/googletest/generated/gtest.pc"
+  "_deps/googletest-build/googletest/generated/gtest_main.pc"
+  "_deps/googletest-build/googletest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/bdd/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/coverage-ut.dir/DependInfo.cmake"
+  "CMakeFiles/coverage-bbh.dir/DependInfo.cmake"
+  "CMakeFiles/coverage-ut-gate.dir/DependInfo.cmake"
+  "CMakeFiles/coverage-bbh-gate.dir/DependInfo.cmake"
+  "CMakeFiles/coverage-gate.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_AlarmClock.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_Calculator.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_Failing.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_FlightBooking.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_Oven.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_NoShortMacros.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_Matchers.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_MultiThreaded.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_GherkinBasket.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_GherkinBackground.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_GherkinTagsAndHooks.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_GherkinUnmatchedStep.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_GherkinCollectFailures.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_GherkinPlaceholders.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_GherkinMultiThreaded.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_GherkinAdvanced.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_GherkinVeryAdvanced.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_GherkinCustomFailureHandler.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_GherkinBakeryStandardOrder.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_GherkinBakeryAllergenSubstitution.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_GherkinBakeryLateCancellation.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_GherkinBakerySeasonalDiscountTiers.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_GherkinBakeryBulkOrderItemized.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_GherkinLibraryStandardLending.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_GherkinLibraryHoldsAndReservations.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_GherkinLibraryOverdueFines.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_GherkinLibraryHoldPickupDeadline.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_GherkinLibraryBookReviewSubmission.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_GherkinBakeryFlakyOvenSensorRetry.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_GherkinLibraryConcurrentLending.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_GherkinBakeryConcurrentOrderProcessing.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_GherkinLibraryPriorityPatronHandling.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_GherkinBakeryDailyOvenLifecycle.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_GherkinBakerySequentialFeatures.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_TestContext.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_BabyBehaveTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_BabyBehaveTest_StepTypes.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_BabyBehaveTest_Exceptions.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_BabyBehaveTest_SoftCheckAndCollectFailures.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_BabyBehaveTest_CallbacksAndDeathTests.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_BabyBehaveTest_NoSourceLocation.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_BabyBehaveTest_NoTiming.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_Gherkin_Parser.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_Gherkin_Integration.dir/DependInfo.cmake"
+  "_deps/googletest-build/googlemock/CMakeFiles/gmock.dir/DependInfo.cmake"
+  "_deps/googletest-build/googlemock/CMakeFiles/gmock_main.dir/DependInfo.cmake"
+  "_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "tests/bdd/CMakeFiles/test_bdd_SelfTest.dir/DependInfo.cmake"
+  "tests/bdd/CMakeFiles/test_bdd_SelfTest_ExceptionCoverage.dir/DependInfo.cmake"
+  "tests/bdd/CMakeFiles/test_bdd_SelfTest_DefaultConditionExit.dir/DependInfo.cmake"
+  "tests/bdd/CMakeFiles/test_bdd_SelfTest_DefaultExceptionExit.dir/DependInfo.cmake"
+  "tests/bdd/CMakeFiles/test_bdd_SelfTest_NoSourceLocation.dir/DependInfo.cmake"
+  "tests/bdd/CMakeFiles/test_bdd_SelfTest_Gherkin.dir/DependInfo.cmake"
+  "tests/bdd/CMakeFiles/test_bdd_SelfTest_Gherkin_DefaultFailureExit.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/coverage-bbh"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/coverage-bbh.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
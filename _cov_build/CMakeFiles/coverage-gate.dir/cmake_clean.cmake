@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/coverage-gate"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/coverage-gate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/coverage-ut-gate"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/coverage-ut-gate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()